@@ -12,7 +12,7 @@ const map<tile, unsigned char> Board::color_codes = {{'B', 0},  // Black.
                                                      {'W', 7}}; // While.
 
 Board::Board(dimension width, dimension height, unsigned short int colors_num) :
-        m_width(width), m_height(height), m_position({0, 0}), m_board(width, vector<tile>(height)) {
+        m_width(width), m_height(height), m_position({0, 0}), m_view({0, 0}), m_board(width, vector<tile>(height)) {
     if ((colors_num > colors.size()) || (colors_num < 2)) {
         throw runtime_error("Invalid number of colors.");
     }
@@ -118,26 +118,160 @@ string Board::zfill(string str, unsigned int length, char filler) {
     return str;
 }
 
-void Board::print_index(const dimension i) {
+void Board::print_index(const dimension i, const string &label) {
     cout << "\033[" << to_string(color_codes.at((i % 2) ? 'W' : 'B') + foreground_color_code) << ";"
-         << to_string(color_codes.at((i % 2) ? 'B' : 'W') + background_color_code) << "m"
-         << zfill(to_string(min((int) i, 99)), 2, '0') << "\033[0m";
+         << to_string(color_codes.at((i % 2) ? 'B' : 'W') + background_color_code) << "m" << label << "\033[0m";
 }
 
-void Board::print(const unsigned int moves) const {
+unsigned int Board::get_label_length() const {
+    return max<unsigned int>(to_string(m_width - 1).length(), 2);
+}
+
+Point Board::get_view_size(const TerminalSize &terminal) const {
+    const unsigned int label_length = get_label_length();
+    const unsigned int used_lines = reserved_lines + (2 * get_header_lines());
+
+    // Space left for tiles, after the index labels and the surrounding text.
+    unsigned int characters = (terminal.first > 2 * label_length) ? terminal.first - (2 * label_length) : 0;
+    unsigned int rows = (terminal.second > used_lines) ? terminal.second - used_lines : 0;
+
+    if ((characters / 2 < m_height) || (rows < m_width)) {
+        // The board does not fit, make room for the minimap.
+        const unsigned int minimap_characters = minimap_gap + min<unsigned int>(m_height, minimap_size);
+        characters = (characters > minimap_characters) ? characters - minimap_characters : 0;
+    }
+
+    // Each tile is two characters wide, show at least a single tile.
+    return {clamp<unsigned int>(rows, 1, m_width), clamp<unsigned int>(characters / 2, 1, m_height)};
+}
+
+Point Board::clamp_view(const OptionalPoint &offset, const Point &view_size) const {
+    return {clamp<optional_dimension>(offset.first, 0, m_width - view_size.first),
+            clamp<optional_dimension>(offset.second, 0, m_height - view_size.second)};
+}
+
+bool Board::move_view(const OptionalPoint &direction, const TerminalSize &terminal) {
+    const Point view_size = get_view_size(terminal);
+    const Point current = clamp_view(m_view, view_size);
+
+    // Pan by half the visible window, so some of the previous view stays visible.
+    m_view = clamp_view(OptionalPoint(current.first + direction.first * max(view_size.first / 2, 1),
+                                      current.second + direction.second * max(view_size.second / 2, 1)), view_size);
+    return m_view != current;
+}
+
+bool Board::focus_view(const TerminalSize &terminal) {
+    const Point view_size = get_view_size(terminal);
+    const Point current = clamp_view(m_view, view_size);
+
+    m_view = clamp_view(OptionalPoint(m_position.first - (view_size.first / 2),
+                                      m_position.second - (view_size.second / 2)), view_size);
+    return m_view != current;
+}
+
+void Board::print_column_indexes(const Point &view, const Point &view_size) const {
+    const string padding(get_label_length(), ' ');
+
+    // Display hundreds digits above the rest, to keep each column two characters wide.
+    if (get_header_lines() == 2) {
+        cout << padding;
+        for (unsigned int y = view.second; y < view.second + view_size.second; y++) {
+            print_index(y, (y >= 100) ? zfill(to_string(y / 100), 2, ' ') : "  ");
+        }
+        cout << endl;
+    }
+
+    cout << padding;
+    for (unsigned int y = view.second; y < view.second + view_size.second; y++) {
+        print_index(y, zfill(to_string(y % 100), 2, '0'));
+    }
+    cout << endl;
+}
+
+BoardData Board::downsample(const Point &size) const {
+    BoardData minimap(size.first, vector<tile>(size.second));
+
+    for (unsigned int row = 0; row < size.first; row++) {
+        for (unsigned int column = 0; column < size.second; column++) {
+            // Count the colors in the tiles covered by the cell, each tile is covered by exactly one cell.
+            map<tile, unsigned int> counts;
+            for (unsigned int x = row * m_width / size.first; x < (row + 1) * m_width / size.first; x++) {
+                for (unsigned int y = column * m_height / size.second;
+                     y < (column + 1) * m_height / size.second; y++) {
+                    if (m_board[x][y] != joker) counts[m_board[x][y]]++;
+                }
+            }
+
+            minimap[row][column] = counts.empty() ? joker : max_element(
+                    counts.cbegin(), counts.cend(), [](const pair<const tile, unsigned int> &first,
+                                                       const pair<const tile, unsigned int> &second) {
+                        return first.second < second.second;
+                    })->first;
+        }
+    }
+
+    return minimap;
+}
+
+void Board::print_minimap_row(const BoardData &minimap, const dimension row, const Point &view,
+                              const Point &view_size) const {
+    const unsigned int rows = minimap.size(), columns = minimap[row].size();
+    const unsigned int first_x = row * m_width / rows, last_x = (row + 1) * m_width / rows;
+    const bool visible_row = (first_x < view.first + view_size.first) && (last_x > view.first);
+
+    cout << string(minimap_gap, ' ');
+    for (unsigned int column = 0; column < columns; column++) {
+        const unsigned int first_y = column * m_height / columns, last_y = (column + 1) * m_height / columns;
+        char mark = ' ';
+
+        if ((m_position.first >= first_x) && (m_position.first < last_x) && (m_position.second >= first_y) &&
+            (m_position.second < last_y)) {
+            // Base position.
+            mark = '@';
+        } else if (visible_row && (first_y < view.second + view_size.second) && (last_y > view.second)) {
+            // Visible part of the board.
+            mark = ':';
+        }
+
+        if (minimap[row][column] == joker) {
+            cout << "\033[1m" << ((mark == ' ') ? 'J' : mark) << "\033[0m";
+        } else {
+            cout << "\033[" << to_string(color_codes.at('B') + foreground_color_code) << ";"
+                 << to_string(color_codes.at(minimap[row][column]) + background_color_code) << "m" << mark
+                 << "\033[0m";
+        }
+    }
+}
+
+void Board::print(const unsigned int moves, const TerminalSize &terminal) const {
+    const Point view_size = get_view_size(terminal);
+    const Point view = clamp_view(m_view, view_size);
+    const unsigned int label_length = get_label_length();
+
+    // Downsample only when part of the board is hidden, keeping the minimap no taller than the visible rows.
+    BoardData minimap;
+    if (is_partial_view(view_size)) {
+        minimap = downsample({min({m_width, (dimension) minimap_size, view_size.first}),
+                              min(m_height, (dimension) minimap_size)});
+    }
+
     // Display title.
-    cout << endl << "--= Board =--" << endl;
+    cout << endl << "--= Board";
+    if (!minimap.empty()) {
+        cout << " (x " << (int) view.second << "-" << view.second + view_size.second - 1 << " of "
+             << (int) m_height << ", y " << (int) view.first << "-" << view.first + view_size.first - 1 << " of "
+             << (int) m_width << ")";
+    }
+    cout << " =--" << endl;
 
     // Display upper indexes (X axis).
-    cout << "  ";
-    for (dimension y = 0; y < m_height; y++) print_index(y);
-    cout << endl;
+    print_column_indexes(view, view_size);
 
     // Display board.
-    for (dimension x = 0; x < m_width; x++) {
+    for (unsigned int x = view.first; x < view.first + view_size.first; x++) {
         // Display left index (Y axis).
-        print_index(x);
-        for (dimension y = 0; y < m_height; y++) {
+        print_index(x, zfill(to_string(x), label_length, '0'));
+        for (unsigned int y = view.second; y < view.second + view_size.second; y++) {
             if (m_board[x][y] == joker) {
                 // Display joker.
                 cout << "\033[1mJK\033[0m";
@@ -151,14 +285,16 @@ void Board::print(const unsigned int moves) const {
             }
         }
         // Display right index (Y axis).
-        print_index(x);
+        print_index(x, zfill(to_string(x), label_length, '0'));
+
+        // Display minimap.
+        if (x - view.first < minimap.size()) print_minimap_row(minimap, x - view.first, view, view_size);
         cout << endl;
     }
 
     // Display lower indexes (X axis).
-    cout << "  ";
-    for (dimension y = 0; y < m_height; y++) print_index(y);
-    cout << endl << endl;
+    print_column_indexes(view, view_size);
+    cout << endl;
 }
 
 bool Board::solved() const {
@@ -28,6 +28,9 @@ typedef pair<dimension, dimension> Point;
 /// Define optional point as a pair of two optional_dimensions: X axis, and Y axis.
 typedef pair<optional_dimension, optional_dimension> OptionalPoint;
 
+/// Define terminal size as a pair of two unsigned short ints: columns, and rows.
+typedef pair<unsigned short int, unsigned short int> TerminalSize;
+
 /**
  * A class that manages the board throughout the game.
  */
@@ -53,6 +56,15 @@ public:
     /// terminal output colors.
     static const map<tile, unsigned char> color_codes;
 
+    /// Number of terminal lines printed around the board rows, excluding the index labels (titles, and prompt).
+    static const unsigned int reserved_lines = 4;
+
+    /// Maximal number of minimap cells in each axis.
+    static const dimension minimap_size = 24;
+
+    /// Number of spaces between the board and the minimap.
+    static const unsigned int minimap_gap = 2;
+
     /**
      * Constructor.
      *
@@ -137,18 +149,48 @@ public:
     static string zfill(string str, unsigned int length, char filler);
 
     /**
-     * Print an index, alternate black and white.
+     * Print an index label, alternate black and white.
+     *
+     * @param i     The index, determines the colors.
+     * @param label The label to print.
+     */
+    static void print_index(dimension i, const string &label);
+
+    /**
+     * Get the size of the visible part of the board.
+     *
+     * The whole board is visible if it fits in the terminal, otherwise room is made for the minimap and only a window
+     * of the board is visible.
+     *
+     * @param terminal  The terminal size.
+     * @return  The number of visible rows (X axis) and columns (Y axis).
+     */
+    [[nodiscard]] Point get_view_size(const TerminalSize &terminal) const;
+
+    /**
+     * Pan the view by half the visible window.
+     *
+     * @param direction The direction to pan, each axis is -1, 0, or 1.
+     * @param terminal  The terminal size.
+     * @return  Did the view move, meaning it was not already at the edge of the board.
+     */
+    bool move_view(const OptionalPoint &direction, const TerminalSize &terminal);
+
+    /**
+     * Center the view around the base.
      *
-     * @param i The index to print.
+     * @param terminal  The terminal size.
+     * @return  Did the view move, meaning it was not already centered around the base.
      */
-    static void print_index(dimension i);
+    bool focus_view(const TerminalSize &terminal);
 
     /**
-     * Print the entire board.
+     * Print the visible part of the board, and a minimap of the whole board if it is not entirely visible.
      *
-     * @param moves Number of moves left.
+     * @param moves     Number of moves left.
+     * @param terminal  The terminal size.
      */
-    void print(unsigned int moves) const;
+    void print(unsigned int moves, const TerminalSize &terminal) const;
 
     /**
      * Check if the board is solved.
@@ -199,6 +241,16 @@ public:
      */
     [[nodiscard]] inline bool has_history() const { return !m_previous_boards.empty(); }
 
+    /**
+     * Check if only part of the board is visible.
+     *
+     * @param view_size The size of the visible part of the board.
+     * @return  Is only part of the board visible.
+     */
+    [[nodiscard]] inline bool is_partial_view(const Point &view_size) const {
+        return (view_size.first < m_width) || (view_size.second < m_height);
+    }
+
     /**
      * Check if the position is inside the board's boundaries.
      *
@@ -212,12 +264,66 @@ public:
 
 private:
 
+    /**
+     * Get the length of the row index labels, enough to show the largest row index.
+     *
+     * @return  The length of the row index labels.
+     */
+    [[nodiscard]] unsigned int get_label_length() const;
+
+    /**
+     * Get the number of lines needed to show the column index labels, two lines for three digit indexes.
+     *
+     * @return  The number of lines of the column index labels.
+     */
+    [[nodiscard]] inline unsigned int get_header_lines() const { return (m_height > 100) ? 2 : 1; }
+
+    /**
+     * Clamp a view offset so the view stays inside the board's boundaries.
+     *
+     * @param offset    The desired offset of the view.
+     * @param view_size The size of the visible part of the board.
+     * @return  The clamped offset.
+     */
+    [[nodiscard]] Point clamp_view(const OptionalPoint &offset, const Point &view_size) const;
+
+    /**
+     * Print the column index labels of the visible columns.
+     *
+     * @param view      The offset of the view.
+     * @param view_size The size of the visible part of the board.
+     */
+    void print_column_indexes(const Point &view, const Point &view_size) const;
+
+    /**
+     * Downsample the board, each cell holds the most common color of the tiles it covers.
+     *
+     * A cell covering only jokers holds a joker.
+     *
+     * @param size  The number of cells in each axis.
+     * @return  The downsampled board.
+     */
+    [[nodiscard]] BoardData downsample(const Point &size) const;
+
+    /**
+     * Print a single row of the minimap, marking the visible part of the board and the base.
+     *
+     * @param minimap   The downsampled board.
+     * @param row       The row to print.
+     * @param view      The offset of the view.
+     * @param view_size The size of the visible part of the board.
+     */
+    void print_minimap_row(const BoardData &minimap, dimension row, const Point &view, const Point &view_size) const;
+
     /// Dimensions of the board, height and width.
     const dimension m_width, m_height;
 
     /// Position of the base.
     Point m_position;
 
+    /// Offset of the view, the upper-left visible position.
+    Point m_view;
+
     /// The current board state, contains all the tiles.
     BoardData m_board;
 
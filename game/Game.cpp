@@ -2,6 +2,14 @@
 
 const set<tile> Game::quit_actions = {'q', 127, 27};
 
+const map<tile, OptionalPoint> Game::pan_actions = {{'h', {0, -1}},  // Left.
+                                                     {'j', {1, 0}},   // Down.
+                                                     {'k', {-1, 0}},  // Up.
+                                                     {'l', {0, 1}}};  // Right.
+
+const TerminalSize Game::unbounded_terminal_size = {numeric_limits<unsigned short int>::max(),
+                                                     numeric_limits<unsigned short int>::max()};
+
 Game::Game(unsigned int moves, dimension width, dimension height, unsigned short int colors_num) :
         m_board(width, height, colors_num), m_moves(moves), m_colors_num(colors_num) {}
 
@@ -22,16 +30,28 @@ char Game::getch() {
     return ch;
 }
 
+TerminalSize Game::get_terminal_size() {
+    struct winsize size{};
+
+    if ((ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == -1) || (size.ws_col == 0) || (size.ws_row == 0)) {
+        return unbounded_terminal_size;
+    }
+
+    return {size.ws_col, size.ws_row};
+}
+
 void Game::turn(bool &quit) {
     tile action;
+    const TerminalSize terminal = get_terminal_size();
 
     // Display current status.
-    m_board.print(m_moves);
+    m_board.print(m_moves, terminal);
     cout << m_moves << " moves left to fill " << m_board.count_remaining_tiles() << " more tiles, Enter action [";
     for (unsigned short int option = 0; option < m_colors_num; option++) {
         if (Board::colors[option] != m_board.get_base()) cout << (char) Board::colors[option];
     }
-    cout << "] (" << (m_board.has_history() ? "u, " : "") << "s): ";
+    cout << "] (" << (m_board.has_history() ? "u, " : "") << "s"
+         << (m_board.is_partial_view(m_board.get_view_size(terminal)) ? ", hjkl, f" : "") << "): ";
 
     // Loop until a valid action has been made.
     while (true) {
@@ -57,6 +77,22 @@ void Game::turn(bool &quit) {
             cin >> y >> x;
             if (!m_board.set_base({x, y})) {
                 cout << "Position is not valid, retry: ";
+            } else {
+                m_board.focus_view(terminal);
+
+                break;
+            }
+        } else if (pan_actions.find(action) != pan_actions.end()) {
+            // Pan view.
+            if (!m_board.move_view(pan_actions.at(action), terminal)) {
+                cout << "Cannot pan further, retry: ";
+            } else {
+                break;
+            }
+        } else if (action == focus_action) {
+            // Focus view on base.
+            if (!m_board.focus_view(terminal)) {
+                cout << "View is already focused on base, retry: ";
             } else {
                 break;
             }
@@ -88,7 +124,8 @@ bool Game::play() {
     cout << "Try to fill the whole board (" << (int) m_board.get_height() << "X" << (int) m_board.get_width() << ") in "
          << m_moves << " moves or less." << endl;
     cout << "Controls are: 'r' - red, 'g' - green, 'b' - blue, 'y' - yellow, 'c' - cyan, 'm' - magenta, 'u' - undo"
-            ", 's' - change base, 'q' ESC DEL BACKSPACE - quit." << endl;
+            ", 's' - change base, 'h' 'j' 'k' 'l' - pan view, 'f' - focus view on base, 'q' ESC DEL BACKSPACE - quit."
+         << endl;
 
     bool quit = false;
     // Run the game.
@@ -102,7 +139,7 @@ bool Game::play() {
         return false;
     }
 
-    m_board.print(m_moves);
+    m_board.print(m_moves, get_terminal_size());
 
     if (m_board.solved()) {
         // Victory.
@@ -3,7 +3,10 @@
 #include "../board/Board.h"
 
 #include <iostream>
+#include <limits>
+#include <sys/ioctl.h>
 #include <termios.h>
+#include <unistd.h>
 
 using namespace std;
 
@@ -19,9 +22,19 @@ public:
     /// Change base action identifier.
     static const tile change_base_action = 's';
 
+    /// Focus view on base action identifier.
+    static const tile focus_action = 'f';
+
     /// Quit action identifiers.
     static const set<tile> quit_actions;
 
+    /// Pan view action identifiers, and their directions.
+    static const map<tile, OptionalPoint> pan_actions;
+
+    /// Terminal size used when it cannot be queried, for example when the output is not a terminal, large enough to
+    /// show the whole board.
+    static const TerminalSize unbounded_terminal_size;
+
     /**
      * Constructor.
      *
@@ -44,6 +57,13 @@ public:
      */
     static char getch();
 
+    /**
+     * Get the terminal size.
+     *
+     * @return  The terminal size, or unbounded_terminal_size if it cannot be queried.
+     */
+    static TerminalSize get_terminal_size();
+
     /**
      * Play a single turn.
      *
@@ -51,7 +71,9 @@ public:
      * 1.   Undo last move ('u') - undo the last move, possible only where previous moves were made.
      * 2.   Change base ('s') - change the base, where the coloring is performed from.
      * 3.   Color ('r', 'g', 'y', 'b', 'm', 'c') - color the base and touching tiles with the same color, recursively.
-     * 4.   Quit ('q', ESC, BACKSPACE, DELETE) - quit the game.
+     * 4.   Pan view ('h', 'j', 'k', 'l') - move the visible part of a board larger than the terminal.
+     * 5.   Focus view ('f') - center the visible part of the board around the base.
+     * 6.   Quit ('q', ESC, BACKSPACE, DELETE) - quit the game.
      *
      * @param quit  Did the player quit.
      */